@@ -21,6 +21,15 @@
 #include <sstream>
 #include <functional>
 #include <iostream>
+#include <unordered_map>
+#include <cstring>
+#include <cstdint>
+
+// SSE2 jest zawsze dostępne na x64; na x86 tylko z -msse2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2 1
+#include <emmintrin.h>
+#endif
 
 // --- IDENTYFIKATORY KONTROLEK (używane później) ---
 #define IDC_EDIT_PATH          101
@@ -30,12 +39,22 @@
 #define IDC_EDIT_NEW_TEXT      105
 #define IDC_BUTTON_START       106
 #define IDC_EDIT_LOG           107
+#define IDC_CHECK_DEDUP        108
+#define IDC_CHECK_IGNORE_CASE  109
+#define IDC_CHECK_WHOLE_WORD   110
 
 // --- ZMIENNE GLOBALNE (deklaracje; przypisania w części GUI) ---
 HWND hEditPath, hEditFilename, hEditOldText, hEditNewText, hEditLog, hButtonStart, hButtonBrowse;
+HWND hCheckDedup, hCheckIgnoreCase, hCheckWholeWord;
 HWND hMainWindow;
 
-struct ThreadData { std::wstring rootPath, targetFilename, oldText, newText; };
+struct ThreadData {
+    std::wstring rootPath, targetFilename, oldText, newText;
+    bool deduplicate = false; // identyczne pliki (te same bajty) przetwarzamy tylko raz
+    unsigned long long dedupCacheLimit = 256ULL * 1024 * 1024; // limit bajtów trzymanych w pamięci deduplikacji (0 = bez limitu)
+    bool ignoreCase = false;  // bez rozróżniania wielkości liter (także Ą/ą, Ł/ł, Ż/ż)
+    bool wholeWord = false;   // tylko całe słowa: old_func nie trafia w old_func_v2
+};
 
 // --- TYPU ENUM: rozpoznawane kodowania ---
 enum class FileEncoding {
@@ -250,39 +269,49 @@ std::wstring bytes_to_wstring_and_detect(const std::vector<char>& bytes, FileEnc
     }
 }
 
-// --- FUNKCJA ZAPISU: zapisuje w tej samej formie (encoding) co podano ---
-bool write_wstring_to_file_with_encoding(const std::filesystem::path& path,
-                                         const std::wstring& content,
-                                         FileEncoding encoding,
-                                         bool writeBOM,
-                                         UINT ansiCodePage = CP_ACP)
+// --- KODOWANIE: wstring -> bajty w podanej formie (encoding), bez zapisu na dysk ---
+std::vector<char> encode_wstring_with_encoding(const std::wstring& content,
+                                               FileEncoding encoding,
+                                               bool writeBOM,
+                                               UINT ansiCodePage = CP_ACP)
 {
-    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
-    if (!ofs.is_open()) return false;
-
     if (encoding == FileEncoding::UTF8_WITH_BOM || encoding == FileEncoding::UTF8_NO_BOM) {
         // UTF-8: zdecydujemy czy zapisać BOM
+        std::vector<char> out;
         if (writeBOM) {
-            ofs.put('\xEF'); ofs.put('\xBB'); ofs.put('\xBF');
+            out.push_back('\xEF'); out.push_back('\xBB'); out.push_back('\xBF');
         }
         std::string bytes = wstring_to_UTF8(content);
-        if (!bytes.empty()) ofs.write(bytes.data(), (std::streamsize)bytes.size());
-        return true;
+        out.insert(out.end(), bytes.begin(), bytes.end());
+        return out;
     } else if (encoding == FileEncoding::UTF16_LE) {
-        std::vector<char> bytes = wstring_to_UTF16LE_bytes(content, writeBOM);
-        if (!bytes.empty()) ofs.write(bytes.data(), (std::streamsize)bytes.size());
-        return true;
+        return wstring_to_UTF16LE_bytes(content, writeBOM);
     } else if (encoding == FileEncoding::UTF16_BE) {
-        std::vector<char> bytes = wstring_to_UTF16BE_bytes(content, writeBOM);
-        if (!bytes.empty()) ofs.write(bytes.data(), (std::streamsize)bytes.size());
-        return true;
+        return wstring_to_UTF16BE_bytes(content, writeBOM);
     } else { // ANSI
         std::string bytes = wstring_to_ANSI(content, ansiCodePage);
-        if (!bytes.empty()) ofs.write(bytes.data(), (std::streamsize)bytes.size());
-        return true;
+        return std::vector<char>(bytes.begin(), bytes.end());
     }
 }
 
+// --- ZAPIS GOTOWYCH BAJTÓW DO PLIKU ---
+bool write_file_bytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) return false;
+    if (!bytes.empty()) ofs.write(bytes.data(), (std::streamsize)bytes.size());
+    return true;
+}
+
+// --- FUNKCJA ZAPISU: zapisuje w tej samej formie (encoding) co podano ---
+bool write_wstring_to_file_with_encoding(const std::filesystem::path& path,
+                                         const std::wstring& content,
+                                         FileEncoding encoding,
+                                         bool writeBOM,
+                                         UINT ansiCodePage = CP_ACP)
+{
+    return write_file_bytes(path, encode_wstring_with_encoding(content, encoding, writeBOM, ansiCodePage));
+}
+
 // main.cpp - część 2/4
 // Logika find/replace, wątek, backup, normalizacja końców linii
 
@@ -328,9 +357,247 @@ void normalize_LF_to_CRLF(std::wstring& s) {
     }
 }
 
+// --- TRYBY DOPASOWANIA: ignorowanie wielkości liter, całe słowa ---
+
+// Tablica składania wielkości liter dla całego BMP (UTF-16), budowana raz przez CharLowerBuffW.
+// ASCII składamy ręcznie, aby wynik zgadzał się ze ścieżką SSE2 niezależnie od locale.
+const wchar_t* case_fold_table() {
+    static const std::vector<wchar_t> table = [] {
+        std::vector<wchar_t> t(0x10000);
+        for (size_t i = 0; i < t.size(); ++i) t[i] = static_cast<wchar_t>(i);
+        // surogaty (D800-DFFF) zostawiamy bez zmian
+        CharLowerBuffW(t.data() + 0x80, 0xD800 - 0x80);
+        CharLowerBuffW(t.data() + 0xE000, 0x10000 - 0xE000);
+        for (wchar_t c = L'A'; c <= L'Z'; ++c) t[c] = c + 0x20;
+        return t;
+    }();
+    return table.data();
+}
+
+// Wzorzec wyszukiwania przygotowany raz na cały przebieg + statystyki czasu
+struct TextMatcher {
+    std::wstring pattern;        // przy ignoreCase: już złożony (małe litery)
+    bool ignoreCase = false;
+    bool wholeWord = false;
+    std::vector<wchar_t> firstNonAscii; // znaki spoza ASCII (≠ pattern[0]) składane do pattern[0], np. Ą dla ą, K (Kelvin) dla k
+    long long ticks = 0;         // łączny czas samego wyszukiwania (QueryPerformanceCounter)
+    unsigned long long charsScanned = 0;
+};
+
+TextMatcher make_text_matcher(const ThreadData* data) {
+    TextMatcher m;
+    m.pattern = data->oldText;
+    m.ignoreCase = data->ignoreCase;
+    m.wholeWord = data->wholeWord;
+    if (m.ignoreCase && !m.pattern.empty()) {
+        const wchar_t* table = case_fold_table();
+        for (wchar_t& c : m.pattern) c = table[static_cast<unsigned short>(c)];
+        for (unsigned c = 0x80; c < 0x10000; ++c) {
+            if (table[c] == m.pattern[0] && c != m.pattern[0]) m.firstNonAscii.push_back(static_cast<wchar_t>(c));
+        }
+    }
+    return m;
+}
+
+#ifdef USE_SSE2
+// Składanie A-Z -> a-z dla 8 znaków UTF-16 naraz
+inline __m128i ascii_fold_epi16(__m128i t) {
+    const __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi16(t, _mm_set1_epi16(L'A' - 1)),
+                                          _mm_cmplt_epi16(t, _mm_set1_epi16(L'Z' + 1)));
+    return _mm_add_epi16(t, _mm_and_si128(isUpper, _mm_set1_epi16(0x20)));
+}
+#endif
+
+// Porównanie tekstu z już złożonym wzorcem bez rozróżniania wielkości liter
+bool equals_folded(const wchar_t* text, const wchar_t* folded, size_t n, const wchar_t* table) {
+    size_t i = 0;
+#ifdef USE_SSE2
+    for (; i + 8 <= n; i += 8) {
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(folded + i));
+        int diff = ~_mm_movemask_epi8(_mm_cmpeq_epi16(ascii_fold_epi16(t), p)) & 0xFFFF;
+        if (!diff) continue;
+        // niezgodne pozycje mogą być literami spoza ASCII (np. Ą vs ą) — rozstrzyga tablica
+        for (int k = 0; k < 8; ++k) {
+            if ((diff >> (2 * k)) & 1) {
+                if (table[static_cast<unsigned short>(text[i + k])] != folded[i + k]) return false;
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (table[static_cast<unsigned short>(text[i])] != folded[i]) return false;
+    }
+    return true;
+}
+
+size_t find_ignore_case(const std::wstring& s, size_t from, const TextMatcher& m) {
+    const size_t n = s.size();
+    const size_t len = m.pattern.size();
+    if (len == 0 || len > n) return std::wstring::npos;
+    const size_t last = n - len;
+    const wchar_t* table = case_fold_table();
+    const wchar_t* text = s.data();
+    const wchar_t* pat = m.pattern.data();
+    const wchar_t f0 = pat[0];
+
+    size_t i = from;
+#ifdef USE_SSE2
+    // szukamy kandydatów na pierwszy znak po 8 naraz: składanie ASCII + porównanie
+    // z każdym znakiem spoza ASCII, który składa się do pattern[0] (zwykle 0 lub 1)
+    // (więcej niż 4 takich znaków praktycznie nie występuje — wtedy zostaje pętla skalarna)
+    const __m128i first = _mm_set1_epi16(static_cast<short>(f0));
+    const size_t extraCount = m.firstNonAscii.size();
+    __m128i extra[4];
+    for (size_t e = 0; e < extraCount && e < 4; ++e) extra[e] = _mm_set1_epi16(static_cast<short>(m.firstNonAscii[e]));
+    for (; extraCount <= 4 && i + 8 <= n && i <= last; i += 8) {
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i cand = _mm_cmpeq_epi16(ascii_fold_epi16(t), first);
+        for (size_t e = 0; e < extraCount; ++e) cand = _mm_or_si128(cand, _mm_cmpeq_epi16(t, extra[e]));
+        int mask = _mm_movemask_epi8(cand);
+        if (!mask) continue;
+        for (int k = 0; k < 8; ++k) {
+            if (!((mask >> (2 * k)) & 1)) continue;
+            size_t p = i + k;
+            if (p > last) return std::wstring::npos;
+            if (table[static_cast<unsigned short>(text[p])] == f0 && equals_folded(text + p, pat, len, table)) return p;
+        }
+    }
+#endif
+    for (; i <= last; ++i) {
+        if (table[static_cast<unsigned short>(text[i])] == f0 && equals_folded(text + i, pat, len, table)) return i;
+    }
+    return std::wstring::npos;
+}
+
+// Znak słowa: litera, cyfra lub podkreślnik
+bool is_word_char(wchar_t c) {
+    return c == L'_' || IsCharAlphaNumericW(c);
+}
+
+// Granice słowa sprawdzamy tylko po stronie, gdzie wzorzec zaczyna/kończy się znakiem słowa
+bool is_whole_word_at(const std::wstring& s, size_t pos, const TextMatcher& m) {
+    const size_t end = pos + m.pattern.size();
+    if (pos > 0 && is_word_char(m.pattern.front()) && is_word_char(s[pos - 1])) return false;
+    if (end < s.size() && is_word_char(m.pattern.back()) && is_word_char(s[end])) return false;
+    return true;
+}
+
+// Następne dopasowanie od pozycji from zgodnie z trybem; npos gdy brak
+size_t find_match(const std::wstring& s, size_t from, const TextMatcher& m) {
+    for (;;) {
+        size_t pos = m.ignoreCase ? find_ignore_case(s, from, m) : s.find(m.pattern, from);
+        if (pos == std::wstring::npos || !m.wholeWord || is_whole_word_at(s, pos, m)) return pos;
+        from = pos + 1;
+    }
+}
+
+// --- DEDUPLIKACJA: HASH TREŚCI PLIKU ---
+// FNV-1a 64-bit — szybki, niekryptograficzny; kolizje weryfikujemy porównaniem bajtów
+uint64_t hash_bytes_fnv1a(const std::vector<char>& bytes) {
+    uint64_t h = 14695981039346656037ULL;
+    for (char c : bytes) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Wynik przekształcenia jednej unikalnej treści (zapamiętany dla duplikatów)
+// Oryginalnych bajtów nie trzymamy — przy trafieniu hasha porównujemy z kopią na dysku:
+// bez zamian to sam firstPath (nie był nadpisany), z zamianami — jego .bak.
+struct DedupEntry {
+    size_t size = 0;               // rozmiar oryginału w bajtach
+    long long count = 0;           // liczba zamian
+    std::filesystem::path firstPath;
+    std::filesystem::path verifyPath; // kopia oryginalnych bajtów na dysku
+    std::vector<char> rawBytes;    // tylko gdy nie udało się utworzyć .bak
+    std::vector<char> outBytes;    // bajty po zamianie (tylko przy count > 0)
+};
+
+// Pamięć podręczna dla jednego przebiegu findAndReplaceLogic
+struct DedupCache {
+    std::unordered_map<uint64_t, std::vector<DedupEntry>> entries;
+    unsigned long long maxBytes = 0;    // 0 = bez limitu
+    unsigned long long cachedBytes = 0; // outBytes + rawBytes trzymane w pamięci
+    int hits = 0;
+    int uniqueFiles = 0;                // tylko treści faktycznie zapisane w pamięci podręcznej
+    int notCached = 0;                  // przetworzone bez zapisu po osiągnięciu limitu (nie wliczane do hit rate)
+    unsigned long long bytesSaved = 0; // bajty nie dekodowane/przeszukiwane ponownie (odczyt z dysku nadal jest)
+};
+
+// Czy rawBytes są identyczne z oryginałem zapamiętanym w e (ponowny odczyt z dysku)
+bool dedup_entry_matches(const DedupEntry& e, const std::vector<char>& rawBytes) {
+    if (e.size != rawBytes.size()) return false;
+    if (rawBytes.empty()) return true;
+    std::vector<char> stored;
+    const std::vector<char>* original = &e.rawBytes;
+    if (e.rawBytes.empty()) {
+        if (!read_file_bytes(e.verifyPath, stored)) return false;
+        original = &stored;
+    }
+    return original->size() == rawBytes.size() &&
+           std::memcmp(original->data(), rawBytes.data(), rawBytes.size()) == 0;
+}
+
+// --- PRZEKSZTAŁCENIE TREŚCI (bez operacji na dysku) ---
+// Zwraca liczbę zamian; przy count > 0 outBytes zawiera gotowe bajty w oryginalnym kodowaniu
+long long transform_file_bytes(const std::vector<char>& rawBytes, const ThreadData* data,
+                               TextMatcher& matcher, std::vector<char>& outBytes) {
+    outBytes.clear();
+
+    FileEncoding detectedEncoding;
+    bool hadBOM = false;
+    std::wstring content = bytes_to_wstring_and_detect(rawBytes, detectedEncoding, hadBOM);
+
+    // Normalizujemy plik do LF, aby wyszukiwanie wieloliniowe się powiodło
+    normalize_CRLF_to_LF(content);
+
+    if (matcher.pattern.empty()) {
+        return 0;
+    }
+
+    // Najpierw samo wyszukiwanie (mierzone), potem składanie wyniku w nowym buforze —
+    // granice słów sprawdzamy na oryginalnym tekście
+    LARGE_INTEGER t0, t1;
+    QueryPerformanceCounter(&t0);
+    std::vector<size_t> matches;
+    size_t pos = 0, from = 0;
+    while ((pos = find_match(content, from, matcher)) != std::wstring::npos) {
+        matches.push_back(pos);
+        from = pos + matcher.pattern.length();
+    }
+    QueryPerformanceCounter(&t1);
+    matcher.ticks += t1.QuadPart - t0.QuadPart;
+    matcher.charsScanned += content.size();
+
+    long long count = (long long)matches.size();
+    if (count == 0) {
+        return 0;
+    }
+
+    std::wstring result;
+    from = 0;
+    for (size_t p : matches) {
+        result.append(content, from, p - from);
+        result += data->newText;
+        from = p + matcher.pattern.length();
+    }
+    result.append(content, from, std::wstring::npos);
+    content.swap(result);
+    normalize_LF_to_CRLF(content);
+
+    bool writeBOM = hadBOM;
+    FileEncoding targetEncoding = detectedEncoding;
+    outBytes = encode_wstring_with_encoding(content, targetEncoding, writeBOM, CP_ACP);
+    return count;
+}
+
 // --- LOGIKA DLA JEDNEGO PLIKU ---
 // Zwraca liczbę dokonanych zamian, -1 przy błędzie
-long long process_single_file(const std::filesystem::path& filepath, const ThreadData* data) {
+// cache == nullptr -> deduplikacja wyłączona
+long long process_single_file(const std::filesystem::path& filepath, const ThreadData* data,
+                              TextMatcher& matcher, DedupCache* cache = nullptr) {
     try {
         std::vector<char> rawBytes;
         if (!read_file_bytes(filepath, rawBytes)) {
@@ -338,49 +605,86 @@ long long process_single_file(const std::filesystem::path& filepath, const Threa
             return -1;
         }
 
-        FileEncoding detectedEncoding;
-        bool hadBOM = false;
-        std::wstring content = bytes_to_wstring_and_detect(rawBytes, detectedEncoding, hadBOM);
-        
-        // Normalizujemy plik do LF, aby wyszukiwanie wieloliniowe się powiodło
-        normalize_CRLF_to_LF(content);
-
-        if (data->oldText.empty()) {
-            return 0;
+        long long count = 0;
+        std::vector<char> computedBytes;
+        const std::vector<char>* outBytes = &computedBytes;
+
+        const DedupEntry* hit = nullptr;
+        uint64_t hash = 0;
+        if (cache) {
+            hash = hash_bytes_fnv1a(rawBytes);
+            auto it = cache->entries.find(hash);
+            if (it != cache->entries.end()) {
+                for (const DedupEntry& e : it->second) {
+                    if (dedup_entry_matches(e, rawBytes)) {
+                        hit = &e;
+                        break;
+                    }
+                }
+            }
         }
 
-        size_t pos = 0;
-        long long count = 0;
-        while ((pos = content.find(data->oldText, pos)) != std::wstring::npos) {
-            content.replace(pos, data->oldText.length(), data->newText);
-            pos += data->newText.length();
-            ++count;
+        if (hit) {
+            ++cache->hits;
+            cache->bytesSaved += rawBytes.size();
+            LogFmt(L" -> Duplicate of: %s", hit->firstPath.wstring().c_str());
+            count = hit->count;
+            outBytes = &hit->outBytes;
+        } else {
+            count = transform_file_bytes(rawBytes, data, matcher, computedBytes);
         }
 
         if (count == 0) {
+            if (cache && !hit) {
+                // plik nie będzie nadpisany — sam służy do weryfikacji duplikatów
+                DedupEntry e;
+                e.size = rawBytes.size();
+                e.firstPath = filepath;
+                e.verifyPath = filepath;
+                cache->entries[hash].push_back(std::move(e));
+                ++cache->uniqueFiles;
+            }
             return 0;
         }
-        
-        normalize_LF_to_CRLF(content);
 
+        bool backupOk = false;
+        std::filesystem::path bak = filepath;
+        bak += L".bak";
         try {
-            std::filesystem::path bak = filepath;
-            bak += L".bak";
             std::error_code ec;
             std::filesystem::copy_file(filepath, bak, std::filesystem::copy_options::overwrite_existing, ec);
             if (ec) {
                 LogFmt(L" -> Warning: Backup file not created: %s", ec.message().c_str());
             } else {
                 LogFmt(L" -> Backup created: %s", bak.wstring().c_str());
+                backupOk = true;
             }
         } catch (const std::exception& e) {
             LogFmt(L" -> Warning: Exception during backup creation: %S", e.what());
         }
 
-        bool writeBOM = hadBOM;
-        FileEncoding targetEncoding = detectedEncoding;
-        
-        bool ok = write_wstring_to_file_with_encoding(filepath, content, targetEncoding, writeBOM, CP_ACP);
+        if (cache && !hit) {
+            // w pamięci trzymamy wynik; oryginał weryfikujemy z .bak, a bez .bak — z kopii w RAM
+            unsigned long long needed = computedBytes.size() + (backupOk ? 0 : rawBytes.size());
+            if (cache->maxBytes == 0 || cache->cachedBytes + needed <= cache->maxBytes) {
+                DedupEntry e;
+                e.size = rawBytes.size();
+                e.count = count;
+                e.firstPath = filepath;
+                if (backupOk) e.verifyPath = bak;
+                else e.rawBytes = rawBytes;
+                e.outBytes = std::move(computedBytes);
+                std::vector<DedupEntry>& bucket = cache->entries[hash];
+                bucket.push_back(std::move(e));
+                outBytes = &bucket.back().outBytes;
+                cache->cachedBytes += needed;
+                ++cache->uniqueFiles;
+            } else {
+                ++cache->notCached;
+            }
+        }
+
+        bool ok = write_file_bytes(filepath, *outBytes);
         if (!ok) {
             LogFmt(L" -> ERROR: Failed to write to file: %s", filepath.wstring().c_str());
             return -1;
@@ -400,6 +704,10 @@ void findAndReplaceLogic(ThreadData* data) {
     try {
         long long totalReplacements = 0;
         int filesProcessed = 0;
+        DedupCache dedupCache;
+        dedupCache.maxBytes = data->dedupCacheLimit;
+        DedupCache* cache = data->deduplicate ? &dedupCache : nullptr;
+        TextMatcher matcher = make_text_matcher(data);
 
         std::filesystem::path rootPath(data->rootPath);
         if (!std::filesystem::exists(rootPath) || !std::filesystem::is_directory(rootPath)) {
@@ -429,7 +737,7 @@ void findAndReplaceLogic(ThreadData* data) {
             ++filesProcessed;
             PostLogMessage(L"Processing: " + entry.path().wstring());
 
-            long long replaced = process_single_file(entry.path(), data);
+            long long replaced = process_single_file(entry.path(), data, matcher, cache);
             if (replaced < 0) {
                 PostLogMessage(L" -> Error during processing.");
             } else if (replaced == 0) {
@@ -443,6 +751,25 @@ void findAndReplaceLogic(ThreadData* data) {
         PostLogMessage(L"\n--- Summary ---");
         PostLogMessage(L"Files processed: " + std::to_wstring(filesProcessed));
         PostLogMessage(L"Total replacements: " + std::to_wstring(totalReplacements));
+
+        const wchar_t* modeName = data->ignoreCase ? (data->wholeWord ? L"ignore case, whole word" : L"ignore case")
+                                                   : (data->wholeWord ? L"exact, whole word" : L"exact");
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        double searchMs = freq.QuadPart > 0 ? 1000.0 * matcher.ticks / freq.QuadPart : 0.0;
+        double mcharsPerSec = searchMs > 0 ? matcher.charsScanned / (searchMs * 1000.0) : 0.0;
+        LogFmt(L"Match mode: %s, search time: %.1f ms over %llu chars (%.1f Mchars/s)",
+               modeName, searchMs, matcher.charsScanned, mcharsPerSec);
+        if (cache) {
+            int looked = cache->hits + cache->uniqueFiles;
+            double hitRate = looked > 0 ? 100.0 * cache->hits / looked : 0.0;
+            LogFmt(L"Deduplication: %d unique, %d duplicates (%.1f%% hit rate), %llu bytes not re-decoded/searched",
+                   cache->uniqueFiles, cache->hits, hitRate, cache->bytesSaved);
+            if (cache->notCached > 0) {
+                LogFmt(L"Deduplication: cache limit reached, %d files processed without caching (excluded from hit rate)",
+                       cache->notCached);
+            }
+        }
     } catch (const std::exception& e) {
         std::string what = e.what();
         std::wstring wwhat(what.begin(), what.end());
@@ -525,6 +852,13 @@ void CreateControls(HWND hwnd) {
 
     hButtonStart = CreateWindowW(L"BUTTON", L"Start", WS_VISIBLE | WS_CHILD,
         10, 515, 80, 30, hwnd, (HMENU)IDC_BUTTON_START, nullptr, nullptr);
+
+    hCheckDedup = CreateWindowW(L"BUTTON", L"Skip duplicate files", WS_VISIBLE | WS_CHILD | BS_AUTOCHECKBOX,
+        100, 520, 150, 20, hwnd, (HMENU)IDC_CHECK_DEDUP, nullptr, nullptr);
+    hCheckIgnoreCase = CreateWindowW(L"BUTTON", L"Ignore case", WS_VISIBLE | WS_CHILD | BS_AUTOCHECKBOX,
+        260, 520, 100, 20, hwnd, (HMENU)IDC_CHECK_IGNORE_CASE, nullptr, nullptr);
+    hCheckWholeWord = CreateWindowW(L"BUTTON", L"Whole word", WS_VISIBLE | WS_CHILD | BS_AUTOCHECKBOX,
+        370, 520, 100, 20, hwnd, (HMENU)IDC_CHECK_WHOLE_WORD, nullptr, nullptr);
 }
 
 // Dopisywanie logu do EDIT
@@ -542,6 +876,9 @@ void SetUIEnabled(BOOL enabled) {
     EnableWindow(hEditOldText, enabled);
     EnableWindow(hEditNewText, enabled);
     EnableWindow(hButtonStart, enabled);
+    EnableWindow(hCheckDedup, enabled);
+    EnableWindow(hCheckIgnoreCase, enabled);
+    EnableWindow(hCheckWholeWord, enabled);
 }
 
 // --- WindowProc ---
@@ -588,6 +925,9 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             SetUIEnabled(FALSE);
 
             ThreadData* data = new ThreadData{ path, filename, oldText, newText };
+            data->deduplicate = SendMessageW(hCheckDedup, BM_GETCHECK, 0, 0) == BST_CHECKED;
+            data->ignoreCase = SendMessageW(hCheckIgnoreCase, BM_GETCHECK, 0, 0) == BST_CHECKED;
+            data->wholeWord = SendMessageW(hCheckWholeWord, BM_GETCHECK, 0, 0) == BST_CHECKED;
             
             HANDLE hThread = CreateThread(nullptr, 0, SearchAndReplaceThread, data, 0, nullptr);
             if (hThread) {